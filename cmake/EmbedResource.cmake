@@ -0,0 +1,21 @@
+# Turns a binary file into a C++ source defining its bytes and size, so it can be
+# linked into the executable and read without touching the filesystem.
+#
+# Usage: cmake -DINPUT=<file> -DOUTPUT=<source> -DSYMBOL=<name> -P EmbedResource.cmake
+
+file(READ "${INPUT}" content HEX)
+string(LENGTH "${content}" hexLength)
+math(EXPR size "${hexLength} / 2")
+
+# 16 bytes per line keeps the generated source readable for the compiler
+set(row "")
+foreach(i RANGE 1 16)
+    set(row "${row}[0-9a-f][0-9a-f]")
+endforeach()
+string(REGEX REPLACE "(${row})" "\\1\n" content "${content}")
+string(REGEX REPLACE "([0-9a-f][0-9a-f])" "0x\\1," bytes "${content}")
+
+file(WRITE "${OUTPUT}"
+    "#include \"resources.h\"\n\n"
+    "const unsigned char ${SYMBOL}[] = {\n${bytes}};\n\n"
+    "const std::size_t ${SYMBOL}_SIZE = ${size};\n")
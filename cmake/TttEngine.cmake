@@ -0,0 +1,25 @@
+# Defines the SDL free tttengine library, shared between the game and the tests.
+
+option(TTT_ENGINE_SHARED "Build tttengine as a shared library" OFF)
+
+find_package(Threads REQUIRED)
+
+set(TTT_ENGINE_ROOT ${CMAKE_CURRENT_LIST_DIR}/..)
+
+if(TTT_ENGINE_SHARED)
+    set(TTT_ENGINE_TYPE SHARED)
+else()
+    set(TTT_ENGINE_TYPE STATIC)
+endif()
+
+add_library(tttengine ${TTT_ENGINE_TYPE}
+    ${TTT_ENGINE_ROOT}/src/engine.cpp
+    ${TTT_ENGINE_ROOT}/src/fieldLines.cpp
+    ${TTT_ENGINE_ROOT}/src/gameRecord.cpp
+    ${TTT_ENGINE_ROOT}/src/solver.cpp
+    ${TTT_ENGINE_ROOT}/src/proofSolver.cpp
+    ${TTT_ENGINE_ROOT}/src/patternEvaluator.cpp)
+target_compile_options(tttengine PRIVATE -std=c++17)
+target_include_directories(tttengine PUBLIC ${TTT_ENGINE_ROOT}/src)
+target_link_libraries(tttengine PUBLIC Threads::Threads)
+set_target_properties(tttengine PROPERTIES POSITION_INDEPENDENT_CODE ON)
@@ -1,12 +1,12 @@
 #include <SDL2/SDL.h>
 #include <vector>
+#include <fstream>
 #include <iostream>
-#include <random>
 #include "controller.h"
 #include "view.h"
 #include "solver.h"
 
-void Controller::execute()
+void Controller::execute(const Uint64 startupStart)
 {
 
     Uint32 titleTimestamp = SDL_GetTicks();
@@ -17,6 +17,7 @@ void Controller::execute()
     bool quit = false;
     bool gameOver = false;
     bool userPlayed = false;
+    std::vector<int> winningLine;
     SDL_bool mouse_active = SDL_FALSE;
     SDL_bool mouse_hover = SDL_FALSE;
 
@@ -25,6 +26,10 @@ void Controller::execute()
     view.drawGridLines();
     view.update();
 
+    // textures are created lazily, so startup only ends once the first frame is shown
+    double startupMs = (SDL_GetPerformanceCounter() - startupStart) * 1000.0 / SDL_GetPerformanceFrequency();
+    SDL_Log("Startup took %.2f ms", startupMs);
+
     while (!quit)
     {
 
@@ -38,32 +43,28 @@ void Controller::execute()
 
             if (solver.isEmptyField(selectedIndex))
             {
+                winningLine = solver.winningLine(solver.getGameField(), selectedIndex, fieldTypeP1);
+                playMove(selectedIndex, fieldTypeP1, MoveSource::PLAYER, 0.0);
 
-                if (solver.isWinningField(selectedIndex, fieldTypeP1))
+                if (!winningLine.empty())
                 {
-
-                    solver.setFieldValue(selectedIndex, fieldTypeP1);
                     gameOver = true;
                 }
                 else
                 {
-                    solver.setFieldValue(selectedIndex, fieldTypeP1);
+                    SearchResult result = solver.search(solver.getGameField(), fieldTypeP2, record.depth);
 
-                    int response = solver.solve(fieldTypeP2, 0);
-
-                    if (solver.getWinningIndex() >= 0)
+                    if (result.bestMove >= 0)
                     {
-                        if (solver.isWinningField(solver.getWinningIndex(), fieldTypeP2))
-                        {
-                            gameOver = true;
-                        }
-                        solver.setFieldValue(solver.getWinningIndex(), fieldTypeP2);
+                        winningLine = result.winningLine;
+                        gameOver = !winningLine.empty();
+                        playMove(result.bestMove, fieldTypeP2, MoveSource::ENGINE, result.seconds);
                     }
                 }
             }
             if (gameOver)
             {
-                view.drawSolution(solver.getWinningIndices());
+                view.drawSolution(winningLine);
             }
             view.drawGridState(solver.getGameField(), fieldTypeP2);
             view.drawGridLines();
@@ -96,19 +97,37 @@ void Controller::execute()
             SDL_Delay(targetFrameDuration - frameDuration);
         }
     }
+
+    writeRecord();
 }
 
 /* PRIVATE */
 
 /*
- * Using uniform distribution, the first move is just a random field.
- * https://en.cppreference.com/w/cpp/numeric/random/uniform_int_distribution
+ * The first move is a random field drawn from the recorded seed, so the game can be replayed.
  */
 void Controller::makeFirstMove(Solver &solver, const FieldType type)
 {
-    std::random_device rd;  //Will be used to obtain a seed for the random number engine
-    std::mt19937 gen(rd()); //Standard mersenne_twister_engine seeded with rd()
-    std::uniform_int_distribution<> dis(0, (frameSize * frameSize) - 1);
-    int startingPosition = dis(gen);
-    solver.setFieldValue(startingPosition, type);
+    playMove(firstMoveFromSeed(record.seed, frameSize), type, MoveSource::FIRST, 0.0);
+}
+
+void Controller::playMove(const int index, const FieldType type, const MoveSource source, const double seconds)
+{
+    solver.setFieldValue(index, type);
+    record.moves.push_back({index, type, source, static_cast<std::uint32_t>(seconds * 1e6)});
+}
+
+void Controller::writeRecord()
+{
+    if (recordPath.empty())
+    {
+        return;
+    }
+
+    std::ofstream out(recordPath, std::ios::binary);
+    record.write(out);
+    if (!out)
+    {
+        std::cerr << "Could not write game record to " << recordPath << "\n";
+    }
 }
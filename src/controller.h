@@ -2,6 +2,9 @@
 #define TIC_TAC_TOE_CONTROLLER_H
 
 #include <SDL2/SDL.h>
+#include <cstdint>
+#include <string>
+#include "gameRecord.h"
 #include "solver.h"
 #include "view.h"
 
@@ -13,19 +16,26 @@ private:
     Solver &solver;
     FieldType fieldTypeP1;
     FieldType fieldTypeP2;
+    GameRecord record;
+    std::string recordPath;
 
     void waitForInput(bool &quit, bool &userPlayed);
 
     void makeFirstMove(Solver &solver, const FieldType type);
 
+    void playMove(const int index, const FieldType type, const MoveSource source, const double seconds);
+
+    void writeRecord();
+
 public:
-    Controller(View &view, Solver &solver) : fieldTypeP1(FieldType::CIRCLE),
-                                             fieldTypeP2(FieldType::CROSS), view(view),
-                                             solver(solver), frameSize(FIELD_SIZE)
+    Controller(View &view, Solver &solver, const std::uint32_t seed, const std::string &recordPath)
+        : fieldTypeP1(FieldType::CIRCLE), fieldTypeP2(FieldType::CROSS), view(view),
+          solver(solver), frameSize(FIELD_SIZE), recordPath(recordPath)
     {
+        record.seed = seed;
     }
 
-    void execute();
+    void execute(const Uint64 startupStart);
 };
 
 #endif
\ No newline at end of file
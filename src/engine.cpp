@@ -0,0 +1,126 @@
+#include <algorithm>
+#include <thread>
+#include <vector>
+#include "engine.h"
+#include "solver.h"
+
+static_assert(FIELD_SIZE * FIELD_SIZE * 2 <= 31, "Game field does not fit into a packed position");
+
+/* Bits between the last field and the side to move, set only in malformed positions */
+static constexpr ttt_position UNUSED_BITS{~TTT_CIRCLE_TO_MOVE & ~((1u << (FIELD_SIZE * FIELD_SIZE * 2)) - 1u)};
+
+/*
+ * Solves positions [begin, end) and returns false on an invalid position or any
+ * exception, which must not escape a worker thread or the C interface.
+ */
+static bool solveRange(const Solver &solver, const ttt_position *positions, ttt_result *results, const size_t begin, const size_t end)
+{
+    try
+    {
+        // one field per worker, reused for every position of its range; a vector since
+        // Solver::search takes one, so this is the only allocation of a worker
+        std::vector<FieldType> gameField(FIELD_SIZE * FIELD_SIZE);
+
+        for (size_t i = begin; i < end; i++)
+        {
+            if (positions[i] & UNUSED_BITS)
+            {
+                return false;
+            }
+
+            for (int index = 0; index < gameField.size(); index++)
+            {
+                switch ((positions[i] >> (2 * index)) & 3u)
+                {
+                case TTT_EMPTY:
+                    gameField[index] = FieldType::EMPTY;
+                    break;
+                case TTT_CROSS:
+                    gameField[index] = FieldType::CROSS;
+                    break;
+                case TTT_CIRCLE:
+                    gameField[index] = FieldType::CIRCLE;
+                    break;
+                default:
+                    return false;
+                }
+            }
+
+            FieldType type = (positions[i] & TTT_CIRCLE_TO_MOVE) ? FieldType::CIRCLE : FieldType::CROSS;
+
+            SearchResult result = solver.search(gameField, type, gameField.size());
+            results[i].bestMove = result.bestMove;
+            results[i].score = result.score;
+        }
+    }
+    catch (...)
+    {
+        return false;
+    }
+    return true;
+}
+
+int ttt_field_size(void)
+{
+    return FIELD_SIZE;
+}
+
+int ttt_solve_batch(const ttt_position *positions, ttt_result *results, size_t count, unsigned threads)
+{
+    if (count > 0 && (positions == nullptr || results == nullptr))
+    {
+        return -1;
+    }
+
+    try
+    {
+        // searches are reentrant, so all workers of all calls share one solver and its tables
+        static const Solver solver;
+
+        if (threads == 0)
+        {
+            threads = std::max(1u, std::thread::hardware_concurrency());
+        }
+        size_t workers = std::min<size_t>(threads, count);
+
+        if (workers <= 1)
+        {
+            return solveRange(solver, positions, results, 0, count) ? 0 : -1;
+        }
+
+        size_t chunk = (count + workers - 1) / workers;
+        std::vector<std::thread> pool;
+        std::vector<char> succeeded((count + chunk - 1) / chunk, 0);
+        pool.reserve(succeeded.size());
+        size_t begin = 0;
+        size_t worker = 0;
+        try
+        {
+            for (; begin < count; begin += chunk, worker++)
+            {
+                pool.emplace_back([positions, results, begin, chunk, count, &succeeded, worker]() {
+                    succeeded[worker] = solveRange(solver, positions, results, begin, std::min(count, begin + chunk));
+                });
+            }
+        }
+        catch (...)
+        {
+            // no more threads available, the calling thread takes over the chunks left
+            std::fill(succeeded.begin() + worker, succeeded.end(), 1);
+            if (!solveRange(solver, positions, results, begin, count))
+            {
+                succeeded[worker] = 0;
+            }
+        }
+        for (auto &running : pool)
+        {
+            running.join();
+        }
+
+        return std::all_of(succeeded.begin(), succeeded.end(), [](char ok) { return ok != 0; }) ? 0 : -1;
+    }
+    catch (...)
+    {
+        return -1;
+    }
+}
@@ -0,0 +1,49 @@
+#ifndef TIC_TAC_TOE_ENGINE_H
+#define TIC_TAC_TOE_ENGINE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*
+ * A position packs 2 bits per field, field i at bits 2i and 2i+1
+ * (0 empty, 1 cross, 2 circle). Bit 31 is the side to move, 0 for cross.
+ */
+typedef uint32_t ttt_position;
+
+#define TTT_EMPTY 0u
+#define TTT_CROSS 1u
+#define TTT_CIRCLE 2u
+#define TTT_CIRCLE_TO_MOVE (1u << 31)
+
+typedef struct
+{
+    /* Field index the side to move should play, -1 if there is none */
+    int32_t bestMove;
+
+    /* Score of Solver::search from the view of the side to move, positive if it wins */
+    int32_t score;
+} ttt_result;
+
+/* Number of fields per row and column of a packed position */
+int ttt_field_size(void);
+
+/*
+ * Solves count positions and writes one result per position into results.
+ * Both arrays are owned by the caller and are not copied. With threads > 1
+ * the positions are split into contiguous chunks, 0 uses all hardware threads.
+ * Returns 0 on success and -1 on invalid arguments, a field holding the unused
+ * value 3, bits set between the last field and bit 31 or any internal error;
+ * results are unspecified in that case.
+ */
+int ttt_solve_batch(const ttt_position *positions, ttt_result *results, size_t count, unsigned threads);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
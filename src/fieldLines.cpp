@@ -0,0 +1,40 @@
+#include <stdexcept>
+#include "fieldLines.h"
+
+void checkFieldSize(const int fieldSize, const int winningSize)
+{
+    if (winningSize < 1 || fieldSize < 1 || winningSize > fieldSize)
+    {
+        throw std::invalid_argument(GAME_FIELD_ERROR);
+    }
+}
+
+std::vector<std::vector<int>> winningWindows(const int fieldSize, const int winningSize)
+{
+    std::vector<std::vector<int>> windows;
+
+    for (auto &direction : LINE_DIRECTIONS)
+    {
+        for (int row = 0; row < fieldSize; row++)
+        {
+            for (int col = 0; col < fieldSize; col++)
+            {
+                int endRow = row + direction[0] * (winningSize - 1);
+                int endCol = col + direction[1] * (winningSize - 1);
+                if (endRow < 0 || endRow >= fieldSize || endCol >= fieldSize)
+                {
+                    continue;
+                }
+
+                std::vector<int> window;
+                for (int i = 0; i < winningSize; i++)
+                {
+                    window.push_back((row + direction[0] * i) * fieldSize + (col + direction[1] * i));
+                }
+                windows.push_back(window);
+            }
+        }
+    }
+
+    return windows;
+}
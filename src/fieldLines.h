@@ -0,0 +1,17 @@
+#ifndef TIC_TAC_TOE_FIELD_LINES_H
+#define TIC_TAC_TOE_FIELD_LINES_H
+
+#include <vector>
+
+#include "globals.h"
+
+/* Row and column steps of the horizontal, vertical and both diagonal lines */
+const int LINE_DIRECTIONS[4][2] = {{0, 1}, {1, 0}, {1, 1}, {-1, 1}};
+
+/* Throws std::invalid_argument if winningSize does not fit into the field */
+void checkFieldSize(const int fieldSize, const int winningSize);
+
+/* Field indices of every horizontal, vertical and diagonal window of winningSize fields */
+std::vector<std::vector<int>> winningWindows(const int fieldSize, const int winningSize);
+
+#endif
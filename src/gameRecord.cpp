@@ -0,0 +1,156 @@
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <random>
+#include <stdexcept>
+#include "gameRecord.h"
+
+static const char RECORD_MAGIC[4] = {'T', 'T', 'T', 'R'};
+static const std::uint8_t RECORD_VERSION{1};
+
+static void writeNumber(std::ostream &out, std::uint32_t value, const int bytes)
+{
+    for (int i = 0; i < bytes; i++)
+    {
+        out.put(static_cast<char>(value & 0xFF));
+        value >>= 8;
+    }
+}
+
+static std::uint32_t readNumber(std::istream &in, const int bytes)
+{
+    std::uint32_t value = 0;
+    for (int i = 0; i < bytes; i++)
+    {
+        int byte = in.get();
+        if (byte == std::char_traits<char>::eof())
+        {
+            throw std::runtime_error(GAME_RECORD_ERROR);
+        }
+        value |= static_cast<std::uint32_t>(byte) << (8 * i);
+    }
+    return value;
+}
+
+void GameRecord::write(std::ostream &out) const
+{
+    out.write(RECORD_MAGIC, sizeof(RECORD_MAGIC));
+    writeNumber(out, RECORD_VERSION, 1);
+    writeNumber(out, fieldSize, 1);
+    writeNumber(out, winningSize, 1);
+    writeNumber(out, depth, 2);
+    writeNumber(out, seed, 4);
+    writeNumber(out, moves.size(), 4);
+
+    for (auto &move : moves)
+    {
+        writeNumber(out, move.index, 2);
+        writeNumber(out, static_cast<std::uint32_t>(move.type), 1);
+        writeNumber(out, static_cast<std::uint32_t>(move.source), 1);
+        writeNumber(out, move.solveMicros, 4);
+    }
+}
+
+GameRecord GameRecord::read(std::istream &in)
+{
+    char magic[sizeof(RECORD_MAGIC)];
+    if (!in.read(magic, sizeof(magic)) || !std::equal(magic, magic + sizeof(magic), RECORD_MAGIC) ||
+        readNumber(in, 1) != RECORD_VERSION)
+    {
+        throw std::runtime_error(GAME_RECORD_ERROR);
+    }
+
+    GameRecord record;
+    record.fieldSize = readNumber(in, 1);
+    record.winningSize = readNumber(in, 1);
+    record.depth = readNumber(in, 2);
+    record.seed = readNumber(in, 4);
+    std::uint32_t moveCount = readNumber(in, 4);
+
+    const int fields = record.fieldSize * record.fieldSize;
+    if (moveCount > fields)
+    {
+        throw std::runtime_error(GAME_RECORD_ERROR);
+    }
+
+    for (std::uint32_t i = 0; i < moveCount; i++)
+    {
+        RecordedMove move;
+        move.index = readNumber(in, 2);
+        std::uint32_t type = readNumber(in, 1);
+        std::uint32_t source = readNumber(in, 1);
+        move.solveMicros = readNumber(in, 4);
+
+        if (move.index >= fields || type < static_cast<std::uint32_t>(FieldType::CROSS) ||
+            type > static_cast<std::uint32_t>(FieldType::CIRCLE) || source > static_cast<std::uint32_t>(MoveSource::ENGINE))
+        {
+            throw std::runtime_error(GAME_RECORD_ERROR);
+        }
+        move.type = static_cast<FieldType>(type);
+        move.source = static_cast<MoveSource>(source);
+        record.moves.push_back(move);
+    }
+
+    return record;
+}
+
+/*
+ * The first move is just a random field. The output of std::mt19937 is fixed by the
+ * standard, unlike std::uniform_int_distribution, so every toolchain maps a seed to
+ * the same field.
+ */
+int firstMoveFromSeed(const std::uint32_t seed, const int fieldSize)
+{
+    std::mt19937 gen(seed); //Standard mersenne_twister_engine, seeded for reproducible games
+    return gen() % (fieldSize * fieldSize);
+}
+
+ReplayReport replayGame(const GameRecord &record, std::ostream &out)
+{
+    ReplayReport report;
+    const Solver solver(record.fieldSize, record.winningSize);
+    std::vector<FieldType> gameField(record.fieldSize * record.fieldSize, FieldType::EMPTY);
+
+    out << "move  field  recorded ms  replayed ms\n";
+
+    for (int i = 0; i < record.moves.size(); i++)
+    {
+        const RecordedMove &move = record.moves[i];
+
+        if (gameField[move.index] != FieldType::EMPTY)
+        {
+            throw std::runtime_error(GAME_RECORD_ERROR);
+        }
+
+        // the recorded field is played anyway, the seed only tells where the game came from
+        if (move.source == MoveSource::FIRST && move.index != firstMoveFromSeed(record.seed, record.fieldSize))
+        {
+            out << std::setw(4) << i << "  warning: first move does not match the seed\n";
+        }
+        else if (move.source == MoveSource::ENGINE)
+        {
+            SearchResult result = solver.search(gameField, move.type, record.depth);
+            double recordedSeconds = move.solveMicros / 1e6;
+
+            report.engineMoves++;
+            report.recordedSeconds += recordedSeconds;
+            report.replayedSeconds += result.seconds;
+
+            out << std::setw(4) << i << std::setw(7) << move.index << std::fixed << std::setprecision(3)
+                << std::setw(13) << recordedSeconds * 1000.0 << std::setw(13) << result.seconds * 1000.0;
+            if (result.bestMove != move.index)
+            {
+                report.mismatches++;
+                out << "  engine now plays " << result.bestMove;
+            }
+            out << "\n";
+        }
+
+        gameField[move.index] = move.type;
+    }
+
+    out << "engine moves: " << report.engineMoves << ", mismatches: " << report.mismatches
+        << ", recorded: " << report.recordedSeconds * 1000.0 << " ms, replayed: " << report.replayedSeconds * 1000.0 << " ms\n";
+
+    return report;
+}
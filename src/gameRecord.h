@@ -0,0 +1,74 @@
+#ifndef TIC_TAC_TOE_GAME_RECORD_H
+#define TIC_TAC_TOE_GAME_RECORD_H
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "globals.h"
+#include "solver.h"
+
+const std::string GAME_RECORD_ERROR{"Not a valid game record!"};
+
+enum class MoveSource
+{
+    FIRST,
+    PLAYER,
+    ENGINE
+};
+
+struct RecordedMove
+{
+    int index;
+    FieldType type;
+    MoveSource source;
+
+    /* Time the engine searched for this move, 0 for other moves */
+    std::uint32_t solveMicros;
+};
+
+/*
+ * Everything needed to play a game again: the seed of the random first move,
+ * the board configuration and every move with the time it took to find.
+ *
+ * Binary layout, all numbers little endian:
+ *   "TTTR" u8 version, u8 fieldSize, u8 winningSize, u16 depth, u32 seed, u32 moveCount
+ *   per move: u16 index, u8 type, u8 source, u32 solveMicros
+ */
+struct GameRecord
+{
+    std::uint32_t seed{0};
+    int fieldSize{FIELD_SIZE};
+    int winningSize{WINNING_SIZE};
+
+    /* Depth passed to Solver::search for engine moves */
+    int depth{FIELD_SIZE * FIELD_SIZE};
+
+    std::vector<RecordedMove> moves;
+
+    void write(std::ostream &out) const;
+
+    static GameRecord read(std::istream &in);
+};
+
+struct ReplayReport
+{
+    int engineMoves{0};
+    int mismatches{0};
+    double recordedSeconds{0.0};
+    double replayedSeconds{0.0};
+};
+
+/* The first move of a game, drawn uniformly from all fields with the given seed */
+int firstMoveFromSeed(const std::uint32_t seed, const int fieldSize);
+
+/*
+ * Plays a recorded game again, searching every engine move with the current
+ * solver. Prints the recorded and replayed time per move to out and counts
+ * moves the engine would now play differently. Throws std::runtime_error if
+ * a move is recorded on a field that is already taken.
+ */
+ReplayReport replayGame(const GameRecord &record, std::ostream &out);
+
+#endif
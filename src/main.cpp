@@ -1,9 +1,105 @@
+#include <SDL2/SDL.h>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
 #include "controller.h"
+#include "gameRecord.h"
 #include "solver.h"
 #include "view.h"
 
-int main()
+/*
+ * Replays a recorded game without opening a window and compares the
+ * engine moves and timings against the recording.
+ */
+int replay(const std::string &path)
 {
+    std::ifstream in(path, std::ios::binary);
+    try
+    {
+        GameRecord record = GameRecord::read(in);
+        ReplayReport report = replayGame(record, std::cout);
+        return (report.mismatches == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+    catch (std::exception const &excpt)
+    {
+        std::cerr << path << ": " << excpt.what() << "\n";
+        return EXIT_FAILURE;
+    }
+}
+
+int usage(const char *program)
+{
+    std::cerr << "Usage: " << program << " [--seed <0-" << UINT32_MAX << ">] [--record <file>]\n"
+              << "       " << program << " --replay <file>\n";
+    return EXIT_FAILURE;
+}
+
+/* Accepts only plain decimal numbers that fit into 32 bits */
+bool parseSeed(const std::string &text, std::uint32_t &seed)
+{
+    if (text.empty() || text.size() > 10 || text.find_first_not_of("0123456789") != std::string::npos)
+    {
+        return false;
+    }
+
+    unsigned long long value = std::stoull(text);
+    if (value > UINT32_MAX)
+    {
+        return false;
+    }
+    seed = static_cast<std::uint32_t>(value);
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    std::uint32_t seed = std::random_device()();
+    std::string recordPath;
+    std::string replayPath;
+
+    for (int i = 1; i < argc; i += 2)
+    {
+        std::string option(argv[i]);
+        if (i + 1 >= argc)
+        {
+            std::cerr << "Missing value for " << option << "\n";
+            return usage(argv[0]);
+        }
+
+        std::string value(argv[i + 1]);
+        if (option == "--replay")
+        {
+            replayPath = value;
+        }
+        else if (option == "--record")
+        {
+            recordPath = value;
+        }
+        else if (option == "--seed")
+        {
+            if (!parseSeed(value, seed))
+            {
+                std::cerr << "Invalid seed " << value << "\n";
+                return usage(argv[0]);
+            }
+        }
+        else
+        {
+            std::cerr << "Unknown option " << option << "\n";
+            return usage(argv[0]);
+        }
+    }
+
+    if (!replayPath.empty())
+    {
+        return replay(replayPath);
+    }
+
+    Uint64 startupStart = SDL_GetPerformanceCounter();
 
     View v;
 
@@ -11,9 +107,9 @@ int main()
 
     Solver s;
 
-    Controller controller(v, s);
+    Controller controller(v, s, seed, recordPath);
 
-    controller.execute();
+    controller.execute(startupStart);
 
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,155 @@
+#include <algorithm>
+#include "fieldLines.h"
+#include "patternEvaluator.h"
+
+PatternEvaluator::PatternEvaluator(const int fieldSize, const int winningSize)
+    : fieldSize(fieldSize), winningSize(winningSize)
+{
+    checkFieldSize(fieldSize, winningSize);
+
+    windows = winningWindows(fieldSize, winningSize);
+    windowsOfField = std::vector<std::vector<int>>(fieldSize * fieldSize);
+    for (int window = 0; window < windows.size(); window++)
+    {
+        for (int index : windows[window])
+        {
+            windowsOfField[index].push_back(window);
+        }
+    }
+
+    neighboursOfField = std::vector<std::vector<int>>(fieldSize * fieldSize);
+    for (int index = 0; index < fieldSize * fieldSize; index++)
+    {
+        int row = index / fieldSize;
+        int col = index % fieldSize;
+        for (int r = std::max(0, row - 2); r <= std::min(fieldSize - 1, row + 2); r++)
+        {
+            for (int c = std::max(0, col - 2); c <= std::min(fieldSize - 1, col + 2); c++)
+            {
+                if (r != row || c != col)
+                {
+                    neighboursOfField[index].push_back(r * fieldSize + c);
+                }
+            }
+        }
+    }
+
+    // each additional stone in a live window is worth eight times more, capped so sums fit into an int
+    weights = std::vector<int>(winningSize + 1, 0);
+    for (int stones = 1; stones <= winningSize; stones++)
+    {
+        weights[stones] = 1 << std::min(3 * (stones - 1), 15);
+    }
+}
+
+PatternState PatternEvaluator::createState(const std::vector<FieldType> &gameField) const
+{
+    PatternState state;
+    state.crossCount = std::vector<int>(windows.size(), 0);
+    state.circleCount = std::vector<int>(windows.size(), 0);
+    state.occupied = std::vector<char>(gameField.size(), 0);
+    state.neighbourCount = std::vector<int>(gameField.size(), 0);
+    state.candidatePosition = std::vector<int>(gameField.size(), -1);
+
+    for (int i = 0; i < gameField.size(); i++)
+    {
+        if (gameField[i] != FieldType::EMPTY)
+        {
+            place(state, i, gameField[i]);
+        }
+    }
+    return state;
+}
+
+bool PatternEvaluator::isWinningMove(const PatternState &state, const int index, const FieldType type) const
+{
+    auto &own = (type == FieldType::CROSS) ? state.crossCount : state.circleCount;
+    auto &other = (type == FieldType::CROSS) ? state.circleCount : state.crossCount;
+
+    for (int window : windowsOfField[index])
+    {
+        if (own[window] == winningSize - 1 && other[window] == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* PRIVATE */
+
+void PatternEvaluator::update(PatternState &state, const int index, const FieldType type, const int delta) const
+{
+    for (int window : windowsOfField[index])
+    {
+        int &cross = state.crossCount[window];
+        int &circle = state.circleCount[window];
+
+        // take the window out of the score, change it and put it back in
+        state.crossScore -= (circle == 0) ? weights[cross] : 0;
+        state.circleScore -= (cross == 0) ? weights[circle] : 0;
+
+        if (type == FieldType::CROSS)
+        {
+            cross += delta;
+        }
+        else
+        {
+            circle += delta;
+        }
+
+        state.crossScore += (circle == 0) ? weights[cross] : 0;
+        state.circleScore += (cross == 0) ? weights[circle] : 0;
+    }
+
+    if (delta > 0)
+    {
+        state.occupied[index] = 1;
+        removeCandidate(state, index);
+        for (int neighbour : neighboursOfField[index])
+        {
+            if (++state.neighbourCount[neighbour] == 1 && !state.occupied[neighbour])
+            {
+                addCandidate(state, neighbour);
+            }
+        }
+    }
+    else
+    {
+        state.occupied[index] = 0;
+        for (int neighbour : neighboursOfField[index])
+        {
+            if (--state.neighbourCount[neighbour] == 0)
+            {
+                removeCandidate(state, neighbour);
+            }
+        }
+        if (state.neighbourCount[index] > 0)
+        {
+            addCandidate(state, index);
+        }
+    }
+    state.stones += delta;
+}
+
+void PatternEvaluator::addCandidate(PatternState &state, const int index) const
+{
+    state.candidatePosition[index] = state.candidates.size();
+    state.candidates.push_back(index);
+}
+
+/* Swaps the last candidate into the gap, so removing does not depend on the number of candidates */
+void PatternEvaluator::removeCandidate(PatternState &state, const int index) const
+{
+    int position = state.candidatePosition[index];
+    if (position < 0)
+    {
+        return;
+    }
+
+    int last = state.candidates.back();
+    state.candidates[position] = last;
+    state.candidatePosition[last] = position;
+    state.candidates.pop_back();
+    state.candidatePosition[index] = -1;
+}
@@ -0,0 +1,84 @@
+#ifndef TIC_TAC_TOE_PATTERN_EVALUATOR_H
+#define TIC_TAC_TOE_PATTERN_EVALUATOR_H
+
+#include <vector>
+
+#include "globals.h"
+
+/*
+ * Static evaluation of non-terminal positions. Every window of winningSize fields
+ * holding stones of only one player is a pattern worth more the fuller it is: an
+ * open three lies in several of those windows, a blocked one in fewer, and a window
+ * containing both players is dead. The score is updated on place and remove by
+ * touching only the windows through that field, so each update is independent of
+ * the board area.
+ *
+ * The same step keeps the candidate moves, the empty fields at most two rows or
+ * columns away from a stone, by counting the stones around every field.
+ *
+ * The evaluator itself only holds read-only tables and can be shared between
+ * threads, the counts of a position live in a PatternState owned by each search.
+ */
+struct PatternState
+{
+    std::vector<int> crossCount;
+
+    std::vector<int> circleCount;
+
+    int crossScore{0};
+
+    int circleScore{0};
+
+    std::vector<char> occupied;
+
+    /* Stones at most two rows or columns away from each field */
+    std::vector<int> neighbourCount;
+
+    /* Empty fields with a stone nearby, in no particular order */
+    std::vector<int> candidates;
+
+    /* Position of each field in candidates, -1 if it is not a candidate */
+    std::vector<int> candidatePosition;
+
+    int stones{0};
+};
+
+class PatternEvaluator
+{
+private:
+    const int fieldSize;
+
+    const int winningSize;
+
+    std::vector<std::vector<int>> windows;
+
+    std::vector<std::vector<int>> windowsOfField;
+
+    std::vector<int> weights;
+
+    std::vector<std::vector<int>> neighboursOfField;
+
+    void update(PatternState &state, const int index, const FieldType type, const int delta) const;
+
+    void addCandidate(PatternState &state, const int index) const;
+
+    void removeCandidate(PatternState &state, const int index) const;
+
+public:
+    PatternEvaluator(const int fieldSize, const int winningSize);
+
+    PatternState createState(const std::vector<FieldType> &gameField) const;
+
+    void place(PatternState &state, const int index, const FieldType type) const { update(state, index, type, 1); }
+
+    void remove(PatternState &state, const int index, const FieldType type) const { update(state, index, type, -1); }
+
+    bool isWinningMove(const PatternState &state, const int index, const FieldType type) const;
+
+    int evaluate(const PatternState &state, const FieldType type) const
+    {
+        return (type == FieldType::CROSS) ? state.crossScore - state.circleScore : state.circleScore - state.crossScore;
+    }
+};
+
+#endif
@@ -0,0 +1,573 @@
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include "fieldLines.h"
+#include "proofSolver.h"
+
+/* Adds value to an unordered list and remembers where it went */
+static void addToList(std::vector<int> &list, std::vector<int> &position, const int value)
+{
+    position[value] = list.size();
+    list.push_back(value);
+}
+
+/* Swaps the last value into the gap, so removing does not depend on the length of the list */
+static void removeFromList(std::vector<int> &list, std::vector<int> &position, const int value)
+{
+    int last = list.back();
+    list[position[value]] = last;
+    position[last] = position[value];
+    list.pop_back();
+    position[value] = -1;
+}
+
+ProofSolver::ProofSolver(const int fieldSize, const int winningSize, const ProofOptions options)
+    : fieldSize(fieldSize), winningSize(winningSize), options(options),
+      minLiveStones(std::max(0, winningSize - 3)), hash(0), nodes(0), aborted(false), attacker(FieldType::CROSS)
+{
+    checkFieldSize(fieldSize, winningSize);
+
+    lines = winningWindows(fieldSize, winningSize);
+    linesOfField = std::vector<std::vector<int>>(fieldSize * fieldSize);
+    for (int line = 0; line < lines.size(); line++)
+    {
+        for (int index : lines[line])
+        {
+            linesOfField[index].push_back(line);
+        }
+    }
+    liveLines[0] = std::vector<std::vector<int>>(winningSize + 1);
+    liveLines[1] = std::vector<std::vector<int>>(winningSize + 1);
+
+    // fixed seed, so hashes and therefore node counts are reproducible between runs
+    std::mt19937_64 gen(0x9E3779B97F4A7C15ULL);
+    zobristKeys = std::vector<std::uint64_t>(fieldSize * fieldSize * 2);
+    for (auto &zobristKey : zobristKeys)
+    {
+        zobristKey = gen();
+    }
+}
+
+ProofResult ProofSolver::solve(const std::vector<FieldType> &gameField, const FieldType type)
+{
+    if (gameField.size() != fieldSize * fieldSize)
+    {
+        throw std::invalid_argument(GAME_FIELD_ERROR);
+    }
+
+    const int fields = fieldSize * fieldSize;
+    board = std::vector<FieldType>(fields, FieldType::EMPTY);
+    hash = 0;
+
+    crossCount = std::vector<int>(lines.size(), 0);
+    circleCount = std::vector<int>(lines.size(), 0);
+    livePosition = std::vector<int>(lines.size(), -1);
+    for (auto &player : liveLines)
+    {
+        for (auto &list : player)
+        {
+            list.clear();
+        }
+    }
+    for (int line = 0; line < lines.size(); line++)
+    {
+        if (std::vector<int> *list = liveList(line))
+        {
+            addToList(*list, livePosition, line);
+        }
+    }
+
+    emptyFields.clear();
+    emptyPosition = std::vector<int>(fields, -1);
+    for (int i = 0; i < fields; i++)
+    {
+        addToList(emptyFields, emptyPosition, i);
+    }
+    seen = std::vector<char>(fields, 0);
+
+    for (int i = 0; i < fields; i++)
+    {
+        if (gameField[i] != FieldType::EMPTY)
+        {
+            play(i, gameField[i]);
+        }
+    }
+
+    ProofResult result;
+    nodes = 0;
+    aborted = false;
+    auto start = std::chrono::steady_clock::now();
+
+    // first try to prove a win for the side to move, then a win for the opponent,
+    // both proofs share the node budget
+    bool orNode = true;
+    if (prove(type, true))
+    {
+        result.status = ProofStatus::WIN;
+    }
+    else if (prove(flipType(type), false))
+    {
+        result.status = ProofStatus::LOSS;
+        orNode = false;
+    }
+
+    if (result.status != ProofStatus::UNKNOWN)
+    {
+        std::unordered_set<std::uint64_t> visited;
+        result.proofSize = countProofTree(orNode, visited);
+        extractProofLine(orNode, result.proofLine);
+        if (!result.proofLine.empty())
+        {
+            result.bestMove = result.proofLine.front();
+        }
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    result.nodes = nodes;
+    result.seconds = elapsed.count();
+    result.nodesPerSecond = (result.seconds > 0.0) ? nodes / result.seconds : 0.0;
+
+    return result;
+}
+
+/* PRIVATE */
+
+FieldType ProofSolver::flipType(FieldType type)
+{
+    if (type == FieldType::CROSS)
+    {
+        return FieldType::CIRCLE;
+    }
+    else
+    {
+        return FieldType::CROSS;
+    }
+}
+
+void ProofSolver::play(const int index, const FieldType type)
+{
+    board[index] = type;
+    hash ^= zobristKeys[zobristIndex(index, type)];
+    update(index, type, 1);
+}
+
+void ProofSolver::undo(const int index, const FieldType type)
+{
+    board[index] = FieldType::EMPTY;
+    hash ^= zobristKeys[zobristIndex(index, type)];
+    update(index, type, -1);
+}
+
+/* Touches only the lines through index, so a move costs the same on any board size */
+void ProofSolver::update(const int index, const FieldType type, const int delta)
+{
+    for (int line : linesOfField[index])
+    {
+        // take the line out of its list, change it and put it back in
+        if (std::vector<int> *list = liveList(line))
+        {
+            removeFromList(*list, livePosition, line);
+        }
+
+        if (type == FieldType::CROSS)
+        {
+            crossCount[line] += delta;
+        }
+        else
+        {
+            circleCount[line] += delta;
+        }
+
+        if (std::vector<int> *list = liveList(line))
+        {
+            addToList(*list, livePosition, line);
+        }
+    }
+
+    if (delta > 0)
+    {
+        removeFromList(emptyFields, emptyPosition, index);
+    }
+    else
+    {
+        addToList(emptyFields, emptyPosition, index);
+    }
+}
+
+std::vector<int> *ProofSolver::liveList(const int line)
+{
+    const int cross = crossCount[line];
+    const int circle = circleCount[line];
+    if ((cross > 0 && circle > 0) || cross + circle < minLiveStones)
+    {
+        return nullptr;
+    }
+    return &liveLines[(circle > 0) ? 1 : 0][cross + circle];
+}
+
+int ProofSolver::emptyField(const int line)
+{
+    for (int index : lines[line])
+    {
+        if (board[index] == FieldType::EMPTY)
+        {
+            return index;
+        }
+    }
+    return -1;
+}
+
+bool ProofSolver::prove(const FieldType attackerType, const bool orNode)
+{
+    attacker = attackerType;
+    table.clear();
+
+    search(orNode, INFINITE, INFINITE);
+
+    TableEntry entry;
+    return lookup(hash, orNode, entry) && entry.pn == 0;
+}
+
+/*
+ * Classifies a node and generates its moves. The attacker is restricted to moves
+ * creating a four (or a three, if enabled), the defender may play any empty field
+ * unless a four of the attacker has to be blocked.
+ */
+ProofSolver::NodeInfo ProofSolver::evaluate(const bool orNode)
+{
+    NodeInfo info;
+    const FieldType toMove = orNode ? attacker : flipType(attacker);
+
+    // the side to move winning at once beats any threat of the opponent
+    const std::vector<int> &ownWins = linesWith(toMove, winningSize - 1);
+    if (!ownWins.empty())
+    {
+        info.terminal = true;
+        info.winningMove = fieldSize * fieldSize;
+        for (int line : ownWins)
+        {
+            info.winningMove = std::min(info.winningMove, emptyField(line));
+        }
+        info.pn = orNode ? 0 : INFINITE;
+        info.dn = orNode ? INFINITE : 0;
+        return info;
+    }
+
+    std::vector<int> otherWins;
+    for (int line : linesWith(flipType(toMove), winningSize - 1))
+    {
+        int index = emptyField(line);
+        if (std::find(otherWins.begin(), otherWins.end(), index) == otherWins.end())
+        {
+            otherWins.push_back(index);
+        }
+    }
+    std::sort(otherWins.begin(), otherWins.end());
+
+    if (otherWins.size() >= 2)
+    {
+        // only one of them can be blocked
+        info.terminal = true;
+        info.moves = otherWins;
+        info.pn = orNode ? INFINITE : 0;
+        info.dn = orNode ? 0 : INFINITE;
+        return info;
+    }
+
+    if (emptyFields.empty())
+    {
+        info.terminal = true;
+        info.pn = INFINITE;
+        info.dn = 0;
+        return info;
+    }
+
+    if (otherWins.size() == 1)
+    {
+        info.moves = otherWins;
+    }
+    else if (orNode)
+    {
+        // fours first; a field creating a four and a three is only tried once, as a four
+        const int minStones = options.useThrees ? winningSize - 3 : winningSize - 2;
+        for (int stones = winningSize - 2; stones >= std::max(minStones, minLiveStones); stones--)
+        {
+            const std::size_t begin = info.moves.size();
+            for (int line : linesWith(attacker, stones))
+            {
+                for (int index : lines[line])
+                {
+                    if (board[index] == FieldType::EMPTY && !seen[index])
+                    {
+                        seen[index] = 1;
+                        info.moves.push_back(index);
+                    }
+                }
+            }
+            std::sort(info.moves.begin() + begin, info.moves.end());
+        }
+        for (int index : info.moves)
+        {
+            seen[index] = 0;
+        }
+    }
+    else
+    {
+        info.moves = emptyFields;
+        std::sort(info.moves.begin(), info.moves.end());
+    }
+
+    if (info.moves.empty())
+    {
+        // the attacker has run out of threats
+        info.terminal = true;
+        info.pn = INFINITE;
+        info.dn = 0;
+    }
+
+    return info;
+}
+
+bool ProofSolver::lookup(const std::uint64_t position, const bool orNode, TableEntry &entry)
+{
+    auto found = table.find(key(position, orNode));
+    if (found == table.end())
+    {
+        entry = {1, 1, 0};
+        return false;
+    }
+    entry = found->second;
+    return true;
+}
+
+void ProofSolver::store(const bool orNode, const std::uint64_t pn, const std::uint64_t dn, const std::uint64_t work)
+{
+    if (table.size() >= options.maxTableEntries)
+    {
+        evict();
+    }
+    table[key(hash, orNode)] = {pn, dn, work};
+}
+
+/*
+ * Keeps the transposition table inside its memory bound. Unsolved entries with
+ * little work behind them are cheapest to recompute and go first, proven
+ * entries are kept as long as possible since the proof line is read from them.
+ */
+void ProofSolver::evict()
+{
+    std::uint64_t totalWork = 0;
+    std::uint64_t unsolved = 0;
+    for (auto &entry : table)
+    {
+        if (entry.second.pn != 0 && entry.second.dn != 0)
+        {
+            totalWork += entry.second.work;
+            unsolved++;
+        }
+    }
+    std::uint64_t averageWork = (unsolved > 0) ? totalWork / unsolved : 0;
+
+    const std::size_t target = options.maxTableEntries * 3 / 4;
+    for (int pass = 0; pass < 3 && table.size() > target; pass++)
+    {
+        for (auto it = table.begin(); it != table.end();)
+        {
+            const TableEntry &entry = it->second;
+            bool evictable = (pass == 0) ? (entry.pn != 0 && entry.dn != 0 && entry.work <= averageWork)
+                             : (pass == 1) ? (entry.pn != 0)
+                                           : true;
+            if (evictable)
+            {
+                it = table.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+}
+
+/*
+ * Depth-first proof-number search (df-pn) based on
+ * Nagai, "Df-pn Algorithm for Searching AND/OR Trees and Its Applications", 2002
+ */
+void ProofSolver::search(const bool orNode, const std::uint64_t thresholdPn, const std::uint64_t thresholdDn)
+{
+    if (nodes >= options.maxNodes)
+    {
+        aborted = true;
+        return;
+    }
+    nodes++;
+
+    NodeInfo info = evaluate(orNode);
+    if (info.terminal)
+    {
+        store(orNode, info.pn, info.dn, 1);
+        return;
+    }
+
+    const FieldType toMove = orNode ? attacker : flipType(attacker);
+    const std::uint64_t nodesBefore = nodes;
+    std::uint64_t pn = 1;
+    std::uint64_t dn = 1;
+
+    while (true)
+    {
+        // OR node: pn is the smallest child pn, dn the sum of child dn; AND node vice versa
+        std::uint64_t minValue = INFINITE;
+        std::uint64_t secondValue = INFINITE;
+        std::uint64_t sum = 0;
+        int bestMove = -1;
+        TableEntry bestEntry{1, 1, 0};
+
+        for (int move : info.moves)
+        {
+            TableEntry child;
+            lookup(hash ^ zobristKeys[zobristIndex(move, toMove)], !orNode, child);
+
+            std::uint64_t minimized = orNode ? child.pn : child.dn;
+            std::uint64_t summed = orNode ? child.dn : child.pn;
+
+            sum = std::min(INFINITE, sum + summed);
+            if (minimized < minValue)
+            {
+                secondValue = minValue;
+                minValue = minimized;
+                bestMove = move;
+                bestEntry = child;
+            }
+            else if (minimized < secondValue)
+            {
+                secondValue = minimized;
+            }
+        }
+
+        pn = orNode ? minValue : sum;
+        dn = orNode ? sum : minValue;
+
+        if (aborted || pn >= thresholdPn || dn >= thresholdDn)
+        {
+            break;
+        }
+
+        std::uint64_t childThresholdPn;
+        std::uint64_t childThresholdDn;
+        if (orNode)
+        {
+            childThresholdPn = std::min(thresholdPn, secondValue + 1);
+            childThresholdDn = thresholdDn - dn + bestEntry.dn;
+        }
+        else
+        {
+            childThresholdPn = thresholdPn - pn + bestEntry.pn;
+            childThresholdDn = std::min(thresholdDn, secondValue + 1);
+        }
+
+        play(bestMove, toMove);
+        search(!orNode, childThresholdPn, childThresholdDn);
+        undo(bestMove, toMove);
+    }
+
+    store(orNode, pn, dn, nodes - nodesBefore + 1);
+}
+
+std::uint64_t ProofSolver::countProofTree(const bool orNode, std::unordered_set<std::uint64_t> &visited)
+{
+    if (!visited.insert(key(hash, orNode)).second)
+    {
+        return 0;
+    }
+
+    NodeInfo info = evaluate(orNode);
+    if (info.terminal)
+    {
+        return 1;
+    }
+
+    const FieldType toMove = orNode ? attacker : flipType(attacker);
+    std::uint64_t size = 1;
+
+    for (int move : info.moves)
+    {
+        TableEntry child;
+        play(move, toMove);
+        bool proven = lookup(hash, !orNode, child) && child.pn == 0;
+        if (proven)
+        {
+            size += countProofTree(!orNode, visited);
+        }
+        undo(move, toMove);
+
+        // a single proven child is enough at an OR node
+        if (proven && orNode)
+        {
+            break;
+        }
+    }
+
+    return size;
+}
+
+/*
+ * Follows the proof from the current position: the attacker takes the proven move
+ * with the least work behind it, the defender the one resisting longest.
+ */
+void ProofSolver::extractProofLine(bool orNode, std::vector<int> &line)
+{
+    std::vector<int> played;
+
+    while (true)
+    {
+        const FieldType toMove = orNode ? attacker : flipType(attacker);
+        NodeInfo info = evaluate(orNode);
+
+        if (info.terminal)
+        {
+            if (info.winningMove >= 0)
+            {
+                line.push_back(info.winningMove);
+            }
+            else if (info.moves.size() >= 2)
+            {
+                line.push_back(info.moves[0]);
+                line.push_back(info.moves[1]);
+            }
+            break;
+        }
+
+        int selected = -1;
+        std::uint64_t selectedWork = 0;
+        for (int move : info.moves)
+        {
+            TableEntry child;
+            if (!lookup(hash ^ zobristKeys[zobristIndex(move, toMove)], !orNode, child) || child.pn != 0)
+            {
+                continue;
+            }
+            if (selected < 0 || (orNode ? child.work < selectedWork : child.work > selectedWork))
+            {
+                selected = move;
+                selectedWork = child.work;
+            }
+        }
+
+        if (selected < 0)
+        {
+            // the rest of the proof has been evicted from the table
+            break;
+        }
+
+        line.push_back(selected);
+        play(selected, toMove);
+        played.push_back(selected);
+        orNode = !orNode;
+    }
+
+    for (auto it = played.rbegin(); it != played.rend(); ++it)
+    {
+        undo(*it, board[*it]);
+    }
+}
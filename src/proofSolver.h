@@ -0,0 +1,164 @@
+#ifndef TIC_TAC_TOE_PROOF_SOLVER_H
+#define TIC_TAC_TOE_PROOF_SOLVER_H
+
+#include <chrono>
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "globals.h"
+
+enum class ProofStatus
+{
+    WIN,
+    LOSS,
+    UNKNOWN
+};
+
+struct ProofOptions
+{
+    /* Let the attacker play moves creating a three, not only fours (VCT instead of VCF) */
+    bool useThrees{true};
+
+    /* Search is aborted with UNKNOWN once this many nodes were expanded, counted over both proofs */
+    std::uint64_t maxNodes{2000000};
+
+    /* Upper bound of transposition table entries, older and cheaper entries are evicted beyond it */
+    std::size_t maxTableEntries{1000000};
+};
+
+struct ProofResult
+{
+    ProofStatus status{ProofStatus::UNKNOWN};
+
+    /* Field index to play, -1 if nothing was proven */
+    int bestMove{-1};
+
+    /* Alternating moves starting with the side to move, ending with the winning move */
+    std::vector<int> proofLine;
+
+    /* Number of distinct positions in the proof tree */
+    std::uint64_t proofSize{0};
+
+    std::uint64_t nodes{0};
+
+    double seconds{0.0};
+
+    double nodesPerSecond{0.0};
+};
+
+/*
+ * Depth-first proof-number search proving wins on k-in-a-row boards of arbitrary size.
+ * The attacker only plays threat moves while the defender answers with every legal move
+ * unless a four forces the reply, so every WIN or LOSS returned is a real proof.
+ */
+class ProofSolver
+{
+private:
+    struct TableEntry
+    {
+        std::uint64_t pn;
+        std::uint64_t dn;
+        std::uint64_t work;
+    };
+
+    struct NodeInfo
+    {
+        bool terminal{false};
+        int winningMove{-1};
+        std::uint64_t pn{1};
+        std::uint64_t dn{1};
+        std::vector<int> moves;
+    };
+
+    static constexpr std::uint64_t INFINITE{std::uint64_t(1) << 48};
+
+    const int fieldSize;
+
+    const int winningSize;
+
+    const ProofOptions options;
+
+    std::vector<std::vector<int>> lines;
+
+    std::vector<std::vector<int>> linesOfField;
+
+    /* Stones of each player in every line, updated on play and undo */
+    std::vector<int> crossCount;
+
+    std::vector<int> circleCount;
+
+    /* Fewest stones of a line still kept in liveLines, the attacker's threes need winningSize - 3 */
+    int minLiveStones;
+
+    /* Lines holding stones of one player only, by player and stones; lines without stones are kept under cross */
+    std::vector<std::vector<int>> liveLines[2];
+
+    /* Position of each line in its liveLines list, -1 if it is in none */
+    std::vector<int> livePosition;
+
+    std::vector<int> emptyFields;
+
+    std::vector<int> emptyPosition;
+
+    /* Marks fields already collected as a threat move, cleared again after every node */
+    std::vector<char> seen;
+
+    std::vector<std::uint64_t> zobristKeys;
+
+    std::unordered_map<std::uint64_t, TableEntry> table;
+
+    std::vector<FieldType> board;
+
+    std::uint64_t hash;
+
+    std::uint64_t nodes;
+
+    bool aborted;
+
+    FieldType attacker;
+
+    FieldType flipType(FieldType type);
+
+    int zobristIndex(const int index, const FieldType type) { return (index * 2) + (type == FieldType::CROSS ? 0 : 1); }
+
+    void play(const int index, const FieldType type);
+
+    void undo(const int index, const FieldType type);
+
+    void update(const int index, const FieldType type, const int delta);
+
+    std::vector<int> *liveList(const int line);
+
+    const std::vector<int> &linesWith(const FieldType type, const int stones) { return liveLines[(stones == 0 || type == FieldType::CROSS) ? 0 : 1][stones]; }
+
+    int emptyField(const int line);
+
+    NodeInfo evaluate(const bool orNode);
+
+    std::uint64_t key(const std::uint64_t position, const bool orNode) { return orNode ? position : ~position; }
+
+    bool lookup(const std::uint64_t position, const bool orNode, TableEntry &entry);
+
+    void store(const bool orNode, const std::uint64_t pn, const std::uint64_t dn, const std::uint64_t work);
+
+    void evict();
+
+    void search(const bool orNode, const std::uint64_t thresholdPn, const std::uint64_t thresholdDn);
+
+    bool prove(const FieldType attackerType, const bool orNode);
+
+    std::uint64_t countProofTree(const bool orNode, std::unordered_set<std::uint64_t> &visited);
+
+    void extractProofLine(bool orNode, std::vector<int> &line);
+
+public:
+    ProofSolver(const int fieldSize, const int winningSize, const ProofOptions options = ProofOptions());
+
+    ProofResult solve(const std::vector<FieldType> &gameField, const FieldType type);
+
+    const std::size_t getTableSize() { return table.size(); }
+};
+
+#endif
@@ -0,0 +1,13 @@
+#ifndef TIC_TAC_TOE_RESOURCES_H
+#define TIC_TAC_TOE_RESOURCES_H
+
+#include <cstddef>
+
+/* Generated at build time from the resources folder, see cmake/EmbedResource.cmake */
+extern const unsigned char RES_HAM_BMP[];
+extern const std::size_t RES_HAM_BMP_SIZE;
+
+extern const unsigned char RES_APPLE_BMP[];
+extern const std::size_t RES_APPLE_BMP_SIZE;
+
+#endif
@@ -1,9 +1,18 @@
 #include <algorithm>
+#include <chrono>
 #include <iostream>
 #include <vector>
 #include <algorithm>
+#include "fieldLines.h"
 #include "solver.h"
 
+Solver::Solver(const int fieldSize, const int winningSize)
+    : winningSize(winningSize), fieldSize(fieldSize), evaluator(fieldSize, winningSize)
+{
+    checkFieldSize(fieldSize, winningSize);
+    gameField = std::vector<FieldType>(fieldSize * fieldSize, FieldType::EMPTY);
+}
+
 bool Solver::isWinningField(const int index, const FieldType type)
 {
     return isWinningField(gameField, index, type);
@@ -84,7 +93,7 @@ bool Solver::containsWinningSize(const std::vector<FieldType> &gameFieldIn, cons
     return false;
 }
 
-bool Solver::isInField(int row, int col)
+bool Solver::isInField(int row, int col) const
 {
     if (col >= 0 && row >= 0 && col < fieldSize && row < fieldSize)
     {
@@ -141,8 +150,157 @@ int Solver::solve(std::vector<FieldType> &gameFieldIn, const FieldType type, int
     return bestScore;
 }
 
+/*
+ * Depth-limited negamax with alpha-beta pruning. Positions at the horizon are
+ * scored by the incrementally updated PatternEvaluator instead of playing on
+ * to the end of the game, so big fields give meaningful moves as well.
+ */
+int Solver::solve(std::vector<FieldType> &gameFieldIn, const FieldType type, int moveCount, const int depth)
+{
+    SearchResult result = runSearch(gameFieldIn, type, moveCount, depth);
+    winningIndex = result.bestMove;
+
+    return result.score;
+}
+
+SearchResult Solver::search(const std::vector<FieldType> &gameFieldIn, const FieldType type, const int depth) const
+{
+    int moveCount = std::count_if(gameFieldIn.begin(), gameFieldIn.end(),
+                                  [](FieldType field) { return field != FieldType::EMPTY; });
+
+    return runSearch(gameFieldIn, type, moveCount, depth);
+}
+
+/*
+ * Searches for a run of at least winningSize fields of type through index,
+ * as if type was played there. Returns the fields of the run or an empty vector.
+ */
+std::vector<int> Solver::winningLine(const std::vector<FieldType> &gameFieldIn, const int index, const FieldType type) const
+{
+    int row = index / fieldSize;
+    int col = index % fieldSize;
+
+    for (auto &direction : LINE_DIRECTIONS)
+    {
+        std::vector<int> line{index};
+        for (int sign : {-1, 1})
+        {
+            int r = row + sign * direction[0];
+            int c = col + sign * direction[1];
+            while (isInField(r, c) && gameFieldIn[r * fieldSize + c] == type)
+            {
+                line.push_back(r * fieldSize + c);
+                r += sign * direction[0];
+                c += sign * direction[1];
+            }
+        }
+
+        if (line.size() >= winningSize)
+        {
+            std::sort(line.begin(), line.end());
+            return line;
+        }
+    }
+
+    return std::vector<int>();
+}
+
 /* PRIVATE  */
-FieldType Solver::flipType(FieldType type)
+
+SearchResult Solver::runSearch(const std::vector<FieldType> &gameFieldIn, const FieldType type, const int moveCount, const int depth) const
+{
+    if (gameFieldIn.size() != fieldSize * fieldSize)
+    {
+        throw std::invalid_argument(GAME_FIELD_ERROR);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    // every search works on its own copy of the field and pattern counts
+    SearchResult result;
+    std::vector<FieldType> field(gameFieldIn);
+    PatternState state = evaluator.createState(field);
+
+    // a move is always chosen, below depth 1 by evaluating every candidate one ply ahead
+    result.score = negamax(field, state, type, moveCount, std::max(depth, 1), -WIN_SCORE - 1, WIN_SCORE + 1, result, true);
+
+    if (result.bestMove >= 0)
+    {
+        result.winningLine = winningLine(field, result.bestMove, type);
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    result.seconds = elapsed.count();
+
+    return result;
+}
+
+int Solver::negamax(std::vector<FieldType> &gameFieldIn, PatternState &state, const FieldType type, const int moveCount,
+                    const int depth, int alpha, const int beta, SearchResult &result, const bool root) const
+{
+    result.nodes++;
+
+    // the candidates change while children are searched, so iterate over a copy,
+    // in field order so the result does not depend on the order stones were placed
+    std::vector<int> moves(state.candidates);
+    std::sort(moves.begin(), moves.end());
+    if (state.stones == 0 && !gameFieldIn.empty())
+    {
+        moves.push_back((fieldSize / 2) * fieldSize + fieldSize / 2);
+    }
+    if (moves.empty())
+    {
+        return 0; // draw
+    }
+
+    for (int i : moves)
+    {
+        if (evaluator.isWinningMove(state, i, type))
+        {
+            if (root)
+            {
+                result.bestMove = i;
+            }
+            return WIN_SCORE - moveCount; // the less moves the better
+        }
+    }
+
+    if (depth <= 0)
+    {
+        return evaluator.evaluate(state, type);
+    }
+
+    int bestScore = -WIN_SCORE - 1;
+
+    for (int i : moves)
+    {
+        gameFieldIn[i] = type;
+        evaluator.place(state, i, type);
+
+        int score = -negamax(gameFieldIn, state, flipType(type), moveCount + 1, depth - 1, -beta, -alpha, result, false);
+
+        evaluator.remove(state, i, type);
+        gameFieldIn[i] = FieldType::EMPTY;
+
+        if (score > bestScore)
+        {
+            bestScore = score;
+            if (root)
+            {
+                result.bestMove = i;
+            }
+        }
+        alpha = std::max(alpha, score);
+        if (alpha >= beta)
+        {
+            break;
+        }
+    }
+
+    return bestScore;
+}
+
+FieldType Solver::flipType(FieldType type) const
 {
     if (type == FieldType::CROSS)
     {
@@ -1,15 +1,33 @@
 #ifndef TIC_TAC_TOE_SOLVER_H
 #define TIC_TAC_TOE_SOLVER_H
 
+#include <cstdint>
 #include <vector>
 #include <stdexcept>
 
 #include "globals.h"
+#include "patternEvaluator.h"
+
+struct SearchResult
+{
+    /* Field index to play, -1 if there is no empty field */
+    int bestMove{-1};
+
+    /* From the view of the side to move, a win scores above any pattern evaluation */
+    int score{0};
+
+    /* Fields of the line completed by bestMove, empty if the move does not win */
+    std::vector<int> winningLine;
+
+    std::uint64_t nodes{0};
+
+    double seconds{0.0};
+};
 
 class Solver
 {
 private:
-    int winningIndex;
+    int winningIndex{-1};
 
     const int winningSize{WINNING_SIZE};
 
@@ -19,12 +37,24 @@ private:
 
     std::vector<FieldType> gameField;
 
-    FieldType flipType(FieldType type);
+    const PatternEvaluator evaluator;
+
+    /* Score of a win in depth-limited search, above any pattern evaluation */
+    static constexpr int WIN_SCORE{1 << 28};
+
+    FieldType flipType(FieldType type) const;
+
+    SearchResult runSearch(const std::vector<FieldType> &gameFieldIn, const FieldType type, const int moveCount, const int depth) const;
+
+    int negamax(std::vector<FieldType> &gameFieldIn, PatternState &state, const FieldType type, const int moveCount,
+                const int depth, int alpha, const int beta, SearchResult &result, const bool root) const;
 
     void dumpGameField(std::vector<FieldType> &gameFieldIn);
 
 public:
-    Solver() : gameField{std::vector<FieldType>(fieldSize * fieldSize, FieldType::EMPTY)} {}
+    Solver() : Solver(FIELD_SIZE, WINNING_SIZE) {}
+
+    Solver(const int fieldSize, const int winningSize);
 
     bool isWinningField(std::vector<FieldType> &gameFieldIn, const int index, const FieldType type);
 
@@ -32,12 +62,19 @@ public:
 
     bool containsWinningSize(const std::vector<FieldType> &gameField, const FieldType type, int row, int col, const int rowIncrement, const int colIncrement);
 
-    bool isInField(int row, int col);
+    bool isInField(int row, int col) const;
+
+    std::vector<int> winningLine(const std::vector<FieldType> &gameFieldIn, const int index, const FieldType type) const;
 
     int solve(const FieldType type, const int moveCount);
 
     int solve(std::vector<FieldType> &gameField, const FieldType type, int moveCount);
 
+    int solve(std::vector<FieldType> &gameField, const FieldType type, int moveCount, const int depth);
+
+    /* Reentrant, only reads shared tables. Depths below 1 search one ply, at least the empty fields to the end */
+    SearchResult search(const std::vector<FieldType> &gameField, const FieldType type, const int depth) const;
+
     /* The Compiler might inline methods defined in the class */
     const int getWinningIndex() { return winningIndex; }
 
@@ -47,9 +84,9 @@ public:
 
     void setFieldValue(const int index, const FieldType type) { gameField[index] = type; }
 
-    const bool isEmptyField(const std::vector<FieldType> &gameFieldIn, const int index) { return (gameFieldIn[index] == FieldType::EMPTY); }
+    const bool isEmptyField(const std::vector<FieldType> &gameFieldIn, const int index) const { return (gameFieldIn[index] == FieldType::EMPTY); }
 
-    bool isEmptyField(const int index) { return isEmptyField(gameField, index); }
+    bool isEmptyField(const int index) const { return isEmptyField(gameField, index); }
 
     FieldType getFieldState(const int index) { return gameField[index]; }
 };
@@ -1,8 +1,9 @@
 #include <vector>
 #include <iostream>
 #include "view.h"
+#include "resources.h"
 
-View::View() : gridCellSize(72), frameSize(FIELD_SIZE)
+View::View() : gridCellSize(72), frameSize(FIELD_SIZE), textureP1(nullptr), textureP2(nullptr)
 {
     windowWidth = (frameSize * gridCellSize) + 1;
     windowHeight = (frameSize * gridCellSize) + 1;
@@ -10,10 +11,14 @@ View::View() : gridCellSize(72), frameSize(FIELD_SIZE)
 
 View::~View()
 {
-    SDL_DestroyTexture(textureP1);
-    SDL_FreeSurface(imageP1);
-    SDL_DestroyTexture(textureP2);
-    SDL_FreeSurface(imageP2);
+    if (textureP1 != nullptr)
+    {
+        SDL_DestroyTexture(textureP1);
+    }
+    if (textureP2 != nullptr)
+    {
+        SDL_DestroyTexture(textureP2);
+    }
     SDL_DestroyRenderer(renderer);
     SDL_DestroyWindow(window);
     SDL_Quit();
@@ -64,14 +69,10 @@ int View::initialize()
     SDL_SetRenderDrawColor(renderer, gridBackground.r, gridBackground.g,
                            gridBackground.b, gridBackground.a);
 
-    imageP1 = SDL_LoadBMP((RES_ROOT_PATH + IMAGE_P1).c_str());
-    textureP1 = SDL_CreateTextureFromSurface(renderer, imageP1);
-
-    imageP2 = SDL_LoadBMP((RES_ROOT_PATH + IMAGE_P2).c_str());
-    textureP2 = SDL_CreateTextureFromSurface(renderer, imageP2);
-
     SDL_RenderClear(renderer);
     drawGridLines();
+
+    return EXIT_SUCCESS;
 }
 
 void View::drawGridLines()
@@ -111,11 +112,11 @@ void View::drawGridState(const std::vector<FieldType> &gameField, const FieldTyp
             SDL_Rect dstrect = {gridCursor.x, gridCursor.y, gridCellSize, gridCellSize};
             if (gameField[i] == fieldTypeP1)
             {
-                SDL_RenderCopy(renderer, textureP1, NULL, &dstrect);
+                SDL_RenderCopy(renderer, getTexture(textureP1, RES_HAM_BMP, RES_HAM_BMP_SIZE), NULL, &dstrect);
             }
             else
             {
-                SDL_RenderCopy(renderer, textureP2, NULL, &dstrect);
+                SDL_RenderCopy(renderer, getTexture(textureP2, RES_APPLE_BMP, RES_APPLE_BMP_SIZE), NULL, &dstrect);
             }
 
             SDL_RenderPresent(renderer);
@@ -174,4 +175,26 @@ void View::waitForInput(bool &quit, bool &userPlayed)
             break;
         }
     }
-}
\ No newline at end of file
+}
+
+/* PRIVATE */
+
+/*
+ * The images are embedded into the executable and decoded straight from memory.
+ * Textures are only created once a player's mark is drawn for the first time.
+ */
+SDL_Texture *View::getTexture(SDL_Texture *&texture, const unsigned char *data, const std::size_t size)
+{
+    if (texture == nullptr)
+    {
+        SDL_Surface *image = SDL_LoadBMP_RW(SDL_RWFromConstMem(data, static_cast<int>(size)), 1);
+        if (image == nullptr)
+        {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Load image: %s", SDL_GetError());
+            return nullptr;
+        }
+        texture = SDL_CreateTextureFromSurface(renderer, image);
+        SDL_FreeSurface(image);
+    }
+    return texture;
+}
@@ -24,11 +24,11 @@ private:
     SDL_Color gridCursorHooverColor;
     SDL_Color gridCursorColor;
 
-    SDL_Surface *imageP1;
     SDL_Texture *textureP1;
-    SDL_Surface *imageP2;
     SDL_Texture *textureP2;
 
+    SDL_Texture *getTexture(SDL_Texture *&texture, const unsigned char *data, const std::size_t size);
+
 public:
     View();
 
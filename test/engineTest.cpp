@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include "../src/engine.h"
+
+static ttt_position pack(const std::vector<unsigned> &fields, const bool circleToMove)
+{
+    ttt_position position = circleToMove ? TTT_CIRCLE_TO_MOVE : 0u;
+    for (int i = 0; i < fields.size(); i++)
+    {
+        position |= fields[i] << (2 * i);
+    }
+    return position;
+}
+
+TEST(EngineTest, testRejectsMissingBuffers)
+{
+    ttt_result result;
+    ttt_position position = 0;
+
+    EXPECT_EQ(-1, ttt_solve_batch(nullptr, &result, 1, 1));
+    EXPECT_EQ(-1, ttt_solve_batch(&position, nullptr, 1, 1));
+    EXPECT_EQ(0, ttt_solve_batch(nullptr, nullptr, 0, 1));
+    EXPECT_EQ(3, ttt_field_size());
+}
+
+TEST(EngineTest, testRejectsInvalidFieldValue)
+{
+    std::vector<ttt_position> positions{0u, 3u << 4};
+    std::vector<ttt_result> results(positions.size());
+
+    EXPECT_EQ(-1, ttt_solve_batch(positions.data(), results.data(), positions.size(), 1));
+    EXPECT_EQ(-1, ttt_solve_batch(positions.data(), results.data(), positions.size(), 2));
+}
+
+TEST(EngineTest, testRejectsUnusedBits)
+{
+    // bit 18 lies right behind the last field of the 3x3 board, bit 30 right before the side to move
+    std::vector<ttt_position> positions{1u << 18, 1u << 30, TTT_CIRCLE_TO_MOVE};
+    std::vector<ttt_result> results(1);
+
+    EXPECT_EQ(-1, ttt_solve_batch(&positions[0], results.data(), 1, 1));
+    EXPECT_EQ(-1, ttt_solve_batch(&positions[1], results.data(), 1, 1));
+    EXPECT_EQ(0, ttt_solve_batch(&positions[2], results.data(), 1, 1));
+}
+
+TEST(EngineTest, testBestMoveIsPlayedFromRoot)
+{
+    // cross on 0 and circle on 4, nobody can win at once
+    std::vector<ttt_position> positions{
+        0u,
+        pack({TTT_CROSS, TTT_EMPTY, TTT_EMPTY,
+              TTT_EMPTY, TTT_CIRCLE, TTT_EMPTY,
+              TTT_EMPTY, TTT_EMPTY, TTT_EMPTY},
+             false)};
+    std::vector<ttt_result> results(positions.size());
+
+    ASSERT_EQ(0, ttt_solve_batch(positions.data(), results.data(), positions.size(), 1));
+
+    // both are draws with best play, so the move must be a legal root move keeping the draw
+    EXPECT_EQ(0, results[0].score);
+    EXPECT_GE(results[0].bestMove, 0);
+    EXPECT_EQ(0, results[1].score);
+    EXPECT_NE(0, results[1].bestMove);
+    EXPECT_NE(4, results[1].bestMove);
+}
+
+TEST(EngineTest, testSolvesBatch)
+{
+    // same positions as SolverTest.testSolving
+    std::vector<ttt_position> positions{
+        pack({TTT_CIRCLE, TTT_CROSS, TTT_CIRCLE,
+              TTT_CIRCLE, TTT_CIRCLE, TTT_CROSS,
+              TTT_CROSS, TTT_CROSS, TTT_EMPTY},
+             false),
+        pack({TTT_CIRCLE, TTT_CROSS, TTT_CIRCLE,
+              TTT_EMPTY, TTT_EMPTY, TTT_CROSS,
+              TTT_CROSS, TTT_CROSS, TTT_EMPTY},
+             false)};
+    std::vector<ttt_result> results(positions.size());
+
+    ASSERT_EQ(0, ttt_solve_batch(positions.data(), results.data(), positions.size(), 1));
+
+    EXPECT_EQ(8, results[0].bestMove);
+    EXPECT_GT(results[0].score, 0);
+    EXPECT_EQ(4, results[1].bestMove);
+    EXPECT_GT(results[1].score, results[0].score); // the earlier win scores higher
+}
+
+TEST(EngineTest, testThreadsMatchSingleThread)
+{
+    std::vector<ttt_position> positions;
+    for (unsigned first = 0; first < 9; first++)
+    {
+        for (unsigned second = 0; second < 9; second++)
+        {
+            if (first != second)
+            {
+                positions.push_back((TTT_CROSS << (2 * first)) | (TTT_CIRCLE << (2 * second)));
+            }
+        }
+    }
+
+    std::vector<ttt_result> single(positions.size());
+    std::vector<ttt_result> parallel(positions.size());
+
+    ASSERT_EQ(0, ttt_solve_batch(positions.data(), single.data(), positions.size(), 1));
+    ASSERT_EQ(0, ttt_solve_batch(positions.data(), parallel.data(), positions.size(), 4));
+
+    for (int i = 0; i < positions.size(); i++)
+    {
+        EXPECT_EQ(single[i].bestMove, parallel[i].bestMove);
+        EXPECT_EQ(single[i].score, parallel[i].score);
+    }
+}
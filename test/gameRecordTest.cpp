@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include "../src/globals.h"
+#include "../src/gameRecord.h"
+#include "../src/solver.h"
+
+/* Plays the engine against itself like the controller does, starting from the seeded first move */
+static GameRecord recordEngineGame(const std::uint32_t seed)
+{
+    const Solver s;
+    GameRecord record;
+    record.seed = seed;
+    std::vector<FieldType> field(FIELD_SIZE * FIELD_SIZE, FieldType::EMPTY);
+
+    int first = firstMoveFromSeed(seed, FIELD_SIZE);
+    field[first] = FieldType::CROSS;
+    record.moves.push_back({first, FieldType::CROSS, MoveSource::FIRST, 0});
+
+    FieldType type = FieldType::CIRCLE;
+    while (true)
+    {
+        SearchResult result = s.search(field, type, record.depth);
+        if (result.bestMove < 0)
+        {
+            break;
+        }
+        field[result.bestMove] = type;
+        record.moves.push_back({result.bestMove, type, MoveSource::ENGINE, static_cast<std::uint32_t>(result.seconds * 1e6)});
+        if (!result.winningLine.empty())
+        {
+            break;
+        }
+        type = (type == FieldType::CROSS) ? FieldType::CIRCLE : FieldType::CROSS;
+    }
+    return record;
+}
+
+TEST(GameRecordTest, testFirstMoveIsDeterministic)
+{
+    EXPECT_EQ(firstMoveFromSeed(7, 3), firstMoveFromSeed(7, 3));
+
+    for (std::uint32_t seed = 0; seed < 100; seed++)
+    {
+        int move = firstMoveFromSeed(seed, 3);
+        EXPECT_GE(move, 0);
+        EXPECT_LT(move, 9);
+    }
+}
+
+TEST(GameRecordTest, testWritesAndReads)
+{
+    GameRecord record = recordEngineGame(1234);
+    std::stringstream stream;
+    record.write(stream);
+
+    // header of 17 bytes and 8 bytes per move
+    EXPECT_EQ(17 + 8 * record.moves.size(), stream.str().size());
+
+    GameRecord read = GameRecord::read(stream);
+    EXPECT_EQ(record.seed, read.seed);
+    EXPECT_EQ(record.fieldSize, read.fieldSize);
+    EXPECT_EQ(record.winningSize, read.winningSize);
+    EXPECT_EQ(record.depth, read.depth);
+    ASSERT_EQ(record.moves.size(), read.moves.size());
+    for (int i = 0; i < record.moves.size(); i++)
+    {
+        EXPECT_EQ(record.moves[i].index, read.moves[i].index);
+        EXPECT_EQ(record.moves[i].type, read.moves[i].type);
+        EXPECT_EQ(record.moves[i].source, read.moves[i].source);
+        EXPECT_EQ(record.moves[i].solveMicros, read.moves[i].solveMicros);
+    }
+}
+
+TEST(GameRecordTest, testRejectsInvalidRecords)
+{
+    std::stringstream empty;
+    EXPECT_THROW(GameRecord::read(empty), std::runtime_error);
+
+    std::stringstream wrongMagic("XXXX");
+    EXPECT_THROW(GameRecord::read(wrongMagic), std::runtime_error);
+
+    std::stringstream stream;
+    recordEngineGame(1).write(stream);
+    std::string truncated = stream.str();
+    truncated.pop_back();
+    std::stringstream truncatedStream(truncated);
+    EXPECT_THROW(GameRecord::read(truncatedStream), std::runtime_error);
+}
+
+TEST(GameRecordTest, testReplaysRecordedGame)
+{
+    GameRecord record = recordEngineGame(42);
+    std::stringstream out;
+
+    ReplayReport report = replayGame(record, out);
+    EXPECT_EQ(record.moves.size() - 1, report.engineMoves);
+    EXPECT_EQ(0, report.mismatches);
+
+    // a move the engine would not play is reported, later moves are dropped so they cannot collide
+    record.moves.resize(2);
+    RecordedMove &engineMove = record.moves[1];
+    engineMove.index = (engineMove.index + 1) % 9 == record.moves[0].index ? (engineMove.index + 2) % 9 : (engineMove.index + 1) % 9;
+    EXPECT_EQ(1, replayGame(record, out).mismatches);
+}
+
+TEST(GameRecordTest, testReplayTrustsRecordedFirstMove)
+{
+    GameRecord record = recordEngineGame(42);
+    std::stringstream out;
+
+    // a first move drawn differently, e.g. by another standard library, is only a warning
+    record.seed = 43;
+    if (firstMoveFromSeed(record.seed, FIELD_SIZE) == record.moves[0].index)
+    {
+        record.seed = 44;
+    }
+    EXPECT_EQ(0, replayGame(record, out).mismatches);
+    EXPECT_NE(std::string::npos, out.str().find("warning"));
+}
+
+TEST(GameRecordTest, testReplayRejectsTakenField)
+{
+    GameRecord record = recordEngineGame(42);
+    std::stringstream out;
+
+    record.moves[1].index = record.moves[0].index;
+    EXPECT_THROW(replayGame(record, out), std::runtime_error);
+}
@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include "../src/globals.h"
+#include "../src/patternEvaluator.h"
+
+TEST(PatternEvaluatorTest, testEmptyFieldIsBalanced)
+{
+    PatternEvaluator e(15, 5);
+    PatternState state = e.createState(std::vector<FieldType>(15 * 15, FieldType::EMPTY));
+
+    EXPECT_EQ(0, e.evaluate(state, FieldType::CROSS));
+    EXPECT_EQ(0, e.evaluate(state, FieldType::CIRCLE));
+    EXPECT_THROW(PatternEvaluator(3, 4), std::invalid_argument);
+}
+
+TEST(PatternEvaluatorTest, testPrefersOpenPatterns)
+{
+    const int fieldSize = 15;
+    const int center = 7 * fieldSize + 7;
+    PatternEvaluator e(fieldSize, 5);
+    std::vector<FieldType> v1(fieldSize * fieldSize, FieldType::EMPTY);
+    PatternState open = e.createState(v1);
+    PatternState blocked = e.createState(v1);
+
+    for (int i = 0; i < 3; i++)
+    {
+        e.place(open, center + i, FieldType::CROSS);
+        e.place(blocked, center + i, FieldType::CROSS);
+    }
+    e.place(open, center + 4 * fieldSize, FieldType::CIRCLE);
+    e.place(blocked, center - 1, FieldType::CIRCLE);
+
+    EXPECT_GT(e.evaluate(open, FieldType::CROSS), e.evaluate(blocked, FieldType::CROSS));
+    EXPECT_EQ(-e.evaluate(open, FieldType::CROSS), e.evaluate(open, FieldType::CIRCLE));
+}
+
+TEST(PatternEvaluatorTest, testIncrementalMatchesReset)
+{
+    const int fieldSize = 9;
+    std::vector<FieldType> v1(fieldSize * fieldSize, FieldType::EMPTY);
+    PatternEvaluator e(fieldSize, 4);
+    PatternState incremental = e.createState(v1);
+
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<> dis(0, fieldSize * fieldSize - 1);
+    FieldType type = FieldType::CROSS;
+
+    for (int move = 0; move < 40; move++)
+    {
+        int index = dis(gen);
+        if (v1[index] == FieldType::EMPTY)
+        {
+            v1[index] = type;
+            e.place(incremental, index, type);
+            type = (type == FieldType::CROSS) ? FieldType::CIRCLE : FieldType::CROSS;
+        }
+        else
+        {
+            e.remove(incremental, index, v1[index]);
+            v1[index] = FieldType::EMPTY;
+        }
+
+        PatternState full = e.createState(v1);
+        ASSERT_EQ(e.evaluate(full, FieldType::CROSS), e.evaluate(incremental, FieldType::CROSS));
+    }
+}
+
+TEST(PatternEvaluatorTest, testIsWinningMove)
+{
+    PatternEvaluator e(3, 3);
+    std::vector<FieldType> v1{FieldType::CIRCLE, FieldType::CROSS, FieldType::CIRCLE,
+                              FieldType::EMPTY, FieldType::CIRCLE, FieldType::CROSS,
+                              FieldType::CROSS, FieldType::CROSS, FieldType::EMPTY};
+    PatternState state = e.createState(v1);
+
+    EXPECT_FALSE(e.isWinningMove(state, 3, FieldType::CIRCLE));
+    EXPECT_TRUE(e.isWinningMove(state, 8, FieldType::CIRCLE));
+    EXPECT_TRUE(e.isWinningMove(state, 8, FieldType::CROSS));
+}
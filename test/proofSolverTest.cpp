@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+#include "../src/globals.h"
+#include "../src/proofSolver.h"
+
+TEST(ProofSolverTest, testConstructsWithProperArguments)
+{
+    EXPECT_THROW(ProofSolver(3, 4), std::invalid_argument);
+    EXPECT_NO_THROW(ProofSolver(15, 5));
+
+    ProofSolver p(3, 3);
+    std::vector<FieldType> v1(4, FieldType::EMPTY);
+    EXPECT_THROW(p.solve(v1, FieldType::CROSS), std::invalid_argument);
+}
+
+TEST(ProofSolverTest, testProvesImmediateWin)
+{
+    ProofSolver p(3, 3);
+    std::vector<FieldType> v1{FieldType::CIRCLE, FieldType::CROSS, FieldType::CIRCLE,
+                              FieldType::CIRCLE, FieldType::CIRCLE, FieldType::CROSS,
+                              FieldType::CROSS, FieldType::CROSS, FieldType::EMPTY};
+
+    ProofResult r1 = p.solve(v1, FieldType::CROSS);
+    EXPECT_EQ(ProofStatus::WIN, r1.status);
+    EXPECT_EQ(8, r1.bestMove);
+    EXPECT_EQ(std::vector<int>{8}, r1.proofLine);
+    EXPECT_EQ(1, r1.proofSize);
+}
+
+TEST(ProofSolverTest, testImmediateWinBeatsDoubleThreat)
+{
+    ProofSolver p(3, 3);
+    // O threatens 2 and 5, but X completes the top row first
+    std::vector<FieldType> v1{FieldType::CROSS, FieldType::CROSS, FieldType::EMPTY,
+                              FieldType::CIRCLE, FieldType::CIRCLE, FieldType::EMPTY,
+                              FieldType::CIRCLE, FieldType::EMPTY, FieldType::EMPTY};
+
+    ProofResult r1 = p.solve(v1, FieldType::CROSS);
+    EXPECT_EQ(ProofStatus::WIN, r1.status);
+    EXPECT_EQ(2, r1.bestMove);
+    EXPECT_EQ(std::vector<int>{2}, r1.proofLine);
+}
+
+TEST(ProofSolverTest, testProvesFork)
+{
+    ProofSolver p(3, 3);
+    // O threatens 6, blocking it gives X two threats at once
+    std::vector<FieldType> v1{FieldType::CROSS, FieldType::EMPTY, FieldType::CIRCLE,
+                              FieldType::EMPTY, FieldType::CIRCLE, FieldType::EMPTY,
+                              FieldType::EMPTY, FieldType::EMPTY, FieldType::CROSS};
+
+    ProofResult r1 = p.solve(v1, FieldType::CROSS);
+    EXPECT_EQ(ProofStatus::WIN, r1.status);
+    EXPECT_EQ(6, r1.bestMove);
+    EXPECT_EQ(3, r1.proofLine.size());
+    EXPECT_GT(r1.proofSize, 1);
+    EXPECT_GT(r1.nodes, 0);
+
+    // after the fork O can only block one of the two threats
+    v1[6] = FieldType::CROSS;
+
+    ProofResult r2 = p.solve(v1, FieldType::CIRCLE);
+    EXPECT_EQ(ProofStatus::LOSS, r2.status);
+    EXPECT_TRUE(r2.bestMove == 3 || r2.bestMove == 7);
+    EXPECT_EQ(2, r2.proofLine.size());
+}
+
+TEST(ProofSolverTest, testEmptyFieldIsUnknown)
+{
+    ProofSolver p(3, 3);
+    std::vector<FieldType> v1(9, FieldType::EMPTY);
+
+    ProofResult r1 = p.solve(v1, FieldType::CROSS);
+    EXPECT_EQ(ProofStatus::UNKNOWN, r1.status);
+    EXPECT_EQ(-1, r1.bestMove);
+    EXPECT_TRUE(r1.proofLine.empty());
+}
+
+TEST(ProofSolverTest, testProvesOpenThreeOnLargeField)
+{
+    const int fieldSize = 15;
+    ProofOptions options;
+    options.useThrees = false;
+    ProofSolver p(fieldSize, 5, options);
+
+    std::vector<FieldType> v1(fieldSize * fieldSize, FieldType::EMPTY);
+    int center = 7 * fieldSize + 7;
+    v1[center - 1] = FieldType::CROSS;
+    v1[center] = FieldType::CROSS;
+    v1[center + 1] = FieldType::CROSS;
+    v1[center + fieldSize] = FieldType::CIRCLE;
+    v1[center - fieldSize] = FieldType::CIRCLE;
+
+    ProofResult r1 = p.solve(v1, FieldType::CROSS);
+    EXPECT_EQ(ProofStatus::WIN, r1.status);
+    EXPECT_EQ(3, r1.proofLine.size());
+    EXPECT_TRUE(r1.bestMove == center - 2 || r1.bestMove == center + 2);
+}
+
+TEST(ProofSolverTest, testLineCountsAreRebuiltForEachSolve)
+{
+    const int fieldSize = 15;
+    ProofSolver p(fieldSize, 5);
+
+    std::vector<FieldType> v1(fieldSize * fieldSize, FieldType::EMPTY);
+    int center = 7 * fieldSize + 7;
+    v1[center - 1] = FieldType::CROSS;
+    v1[center] = FieldType::CROSS;
+    v1[center + 1] = FieldType::CROSS;
+    v1[center + fieldSize] = FieldType::CIRCLE;
+    v1[center - fieldSize] = FieldType::CIRCLE;
+
+    // the counts of the three must not leak into the empty field solved in between
+    ProofResult r1 = p.solve(v1, FieldType::CROSS);
+    ProofResult r2 = p.solve(std::vector<FieldType>(fieldSize * fieldSize, FieldType::EMPTY), FieldType::CROSS);
+    ProofResult r3 = p.solve(v1, FieldType::CROSS);
+
+    EXPECT_EQ(ProofStatus::WIN, r1.status);
+    EXPECT_EQ(ProofStatus::UNKNOWN, r2.status);
+    EXPECT_EQ(r1.proofLine, r3.proofLine);
+    EXPECT_EQ(r1.nodes, r3.nodes);
+}
+
+TEST(ProofSolverTest, testRespectsNodeLimit)
+{
+    const int fieldSize = 15;
+    ProofOptions options;
+    options.maxNodes = 1000;
+    options.maxTableEntries = 100;
+    ProofSolver p(fieldSize, 5, options);
+
+    std::vector<FieldType> v1(fieldSize * fieldSize, FieldType::EMPTY);
+    v1[7 * fieldSize + 7] = FieldType::CROSS;
+
+    ProofResult r1 = p.solve(v1, FieldType::CIRCLE);
+    EXPECT_EQ(ProofStatus::UNKNOWN, r1.status);
+    EXPECT_LE(r1.nodes, options.maxNodes);
+    EXPECT_LE(p.getTableSize(), options.maxTableEntries);
+}
@@ -1,8 +1,10 @@
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <stdexcept>
+#include <thread>
 #include <vector>
 #include "../src/globals.h"
-#include "../src/solver.cpp"
+#include "../src/solver.h"
 
 TEST(SolverTest, testConstructsWithProperArguments)
 {
@@ -133,4 +135,180 @@ TEST(SolverTest, testSolving)
                               FieldType::EMPTY, FieldType::CIRCLE, FieldType::CROSS,
                               FieldType::CROSS, FieldType::CROSS, FieldType::CIRCLE};
     EXPECT_GT(s.solve(v3, FieldType::CROSS, 8), 0); // losing game
-}
\ No newline at end of file
+}
+
+TEST(SolverTest, testConstructsWithFieldSize)
+{
+    EXPECT_THROW(Solver(3, 4), std::invalid_argument);
+    EXPECT_THROW(Solver(0, 0), std::invalid_argument);
+
+    Solver s(15, 5);
+    EXPECT_EQ(225, s.getGameField().size());
+}
+
+TEST(SolverTest, testDepthLimitedSolving)
+{
+    Solver s;
+    std::vector<FieldType> v1{FieldType::CIRCLE, FieldType::CROSS, FieldType::CIRCLE,
+                              FieldType::EMPTY, FieldType::EMPTY, FieldType::CROSS,
+                              FieldType::CROSS, FieldType::CROSS, FieldType::EMPTY};
+
+    EXPECT_GT(s.solve(v1, FieldType::CROSS, 6, 1), 0);
+    EXPECT_EQ(4, s.getWinningIndex());
+
+    // circle has to block the cross at 3
+    std::vector<FieldType> v2{FieldType::CROSS, FieldType::CIRCLE, FieldType::EMPTY,
+                              FieldType::EMPTY, FieldType::EMPTY, FieldType::EMPTY,
+                              FieldType::CROSS, FieldType::EMPTY, FieldType::CIRCLE};
+
+    s.solve(v2, FieldType::CIRCLE, 4, 2);
+    EXPECT_EQ(3, s.getWinningIndex());
+}
+
+TEST(SolverTest, testDepthLimitedSolvingOnLargeField)
+{
+    const int fieldSize = 15;
+    Solver s(fieldSize, 5);
+    std::vector<FieldType> v1(fieldSize * fieldSize, FieldType::EMPTY);
+    int center = 7 * fieldSize + 7;
+
+    // a four of cross blocked on the left, circle to move has to close it on the right
+    v1[center - 2] = FieldType::CIRCLE;
+    for (int i = -1; i < 3; i++)
+    {
+        v1[center + i] = FieldType::CROSS;
+    }
+    v1[center + fieldSize] = FieldType::CIRCLE;
+    v1[center + 2 * fieldSize] = FieldType::CIRCLE;
+
+    s.solve(v1, FieldType::CIRCLE, 7, 2);
+    EXPECT_EQ(center + 3, s.getWinningIndex());
+
+    // the field is left as it was
+    EXPECT_EQ(7, std::count_if(v1.begin(), v1.end(), [](FieldType type) { return type != FieldType::EMPTY; }));
+}
+
+TEST(SolverTest, testSearch)
+{
+    const Solver s;
+    std::vector<FieldType> v1{FieldType::CIRCLE, FieldType::CROSS, FieldType::CIRCLE,
+                              FieldType::EMPTY, FieldType::EMPTY, FieldType::CROSS,
+                              FieldType::CROSS, FieldType::CROSS, FieldType::EMPTY};
+
+    SearchResult r1 = s.search(v1, FieldType::CROSS, 9);
+    EXPECT_EQ(4, r1.bestMove);
+    EXPECT_GT(r1.score, 0);
+    EXPECT_EQ((std::vector<int>{1, 4, 7}), r1.winningLine);
+    EXPECT_GT(r1.nodes, 0);
+
+    // circle has to block, which does not win
+    std::vector<FieldType> v2{FieldType::CROSS, FieldType::CIRCLE, FieldType::EMPTY,
+                              FieldType::EMPTY, FieldType::EMPTY, FieldType::EMPTY,
+                              FieldType::CROSS, FieldType::EMPTY, FieldType::CIRCLE};
+
+    SearchResult r2 = s.search(v2, FieldType::CIRCLE, 9);
+    EXPECT_EQ(3, r2.bestMove);
+    EXPECT_TRUE(r2.winningLine.empty());
+
+    // the empty field is a draw
+    SearchResult r3 = s.search(std::vector<FieldType>(9, FieldType::EMPTY), FieldType::CROSS, 9);
+    EXPECT_EQ(0, r3.score);
+
+    EXPECT_THROW(s.search(std::vector<FieldType>(4, FieldType::EMPTY), FieldType::CROSS, 1), std::invalid_argument);
+}
+
+TEST(SolverTest, testSearchWithoutDepth)
+{
+    const int fieldSize = 15;
+    const Solver s(fieldSize, 5);
+    std::vector<FieldType> v1(fieldSize * fieldSize, FieldType::EMPTY);
+    v1[7 * fieldSize + 7] = FieldType::CROSS;
+
+    // still a move next to the stone, chosen by one-ply evaluation
+    for (int depth : {0, -1})
+    {
+        SearchResult r1 = s.search(v1, FieldType::CIRCLE, depth);
+        EXPECT_GE(r1.bestMove, 0);
+        EXPECT_EQ(FieldType::EMPTY, v1[r1.bestMove]);
+        EXPECT_EQ(r1.bestMove, s.search(v1, FieldType::CIRCLE, 1).bestMove);
+    }
+}
+
+TEST(SolverTest, testWinningLine)
+{
+    Solver s;
+    std::vector<FieldType> v1{FieldType::CIRCLE, FieldType::CROSS, FieldType::CIRCLE,
+                              FieldType::EMPTY, FieldType::CIRCLE, FieldType::CROSS,
+                              FieldType::CROSS, FieldType::CROSS, FieldType::EMPTY};
+
+    EXPECT_TRUE(s.winningLine(v1, 3, FieldType::CIRCLE).empty());
+    EXPECT_EQ((std::vector<int>{0, 4, 8}), s.winningLine(v1, 8, FieldType::CIRCLE));
+    EXPECT_EQ((std::vector<int>{6, 7, 8}), s.winningLine(v1, 8, FieldType::CROSS));
+}
+
+TEST(SolverTest, testConcurrentSearch)
+{
+    const int fieldSize = 15;
+    const Solver s(fieldSize, 5);
+    std::vector<std::vector<FieldType>> fields;
+    for (int i = 0; i < 8; i++)
+    {
+        std::vector<FieldType> field(fieldSize * fieldSize, FieldType::EMPTY);
+        field[7 * fieldSize + 7] = FieldType::CROSS;
+        field[i * fieldSize + 3] = FieldType::CIRCLE;
+        field[7 * fieldSize + 8] = FieldType::CROSS;
+        fields.push_back(field);
+    }
+
+    std::vector<SearchResult> expected;
+    for (auto &field : fields)
+    {
+        expected.push_back(s.search(field, FieldType::CIRCLE, 2));
+    }
+
+    std::vector<SearchResult> concurrent(fields.size());
+    std::vector<std::thread> threads;
+    for (int i = 0; i < fields.size(); i++)
+    {
+        threads.emplace_back([&s, &fields, &concurrent, i]() { concurrent[i] = s.search(fields[i], FieldType::CIRCLE, 2); });
+    }
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    for (int i = 0; i < fields.size(); i++)
+    {
+        EXPECT_EQ(expected[i].bestMove, concurrent[i].bestMove);
+        EXPECT_EQ(expected[i].score, concurrent[i].score);
+        EXPECT_EQ(expected[i].nodes, concurrent[i].nodes);
+    }
+}
+
+TEST(SolverTest, testNodeCostIndependentOfFieldSize)
+{
+    // same stones in the middle of a small and a large field, best of three runs against timer noise
+    std::vector<double> secondsPerNode;
+    for (int fieldSize : {15, 61})
+    {
+        const Solver s(fieldSize, 5);
+        std::vector<FieldType> field(fieldSize * fieldSize, FieldType::EMPTY);
+        int center = (fieldSize / 2) * fieldSize + fieldSize / 2;
+        field[center] = FieldType::CROSS;
+        field[center + 1] = FieldType::CROSS;
+        field[center + fieldSize] = FieldType::CIRCLE;
+        field[center - fieldSize + 1] = FieldType::CIRCLE;
+
+        double best = 0.0;
+        for (int run = 0; run < 3; run++)
+        {
+            SearchResult result = s.search(field, FieldType::CROSS, 2);
+            double cost = result.seconds / result.nodes;
+            best = (run == 0) ? cost : std::min(best, cost);
+        }
+        secondsPerNode.push_back(best);
+    }
+
+    // the large field has 16 times the area, scanning it per node made it about 18 times slower
+    EXPECT_LT(secondsPerNode[1], 2.5 * secondsPerNode[0]);
+}
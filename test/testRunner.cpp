@@ -1,5 +1,9 @@
 #include <gtest/gtest.h>
 #include "solverTest.cpp"
+#include "proofSolverTest.cpp"
+#include "engineTest.cpp"
+#include "patternEvaluatorTest.cpp"
+#include "gameRecordTest.cpp"
 
 // Test Suite
 